@@ -23,6 +23,8 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 
 #include <cassert>
 #include <stdint.h>
+#include <stdlib.h>
+#include <new>
 
 //=================================================================================================
 // Variables, literals, lifted booleans, clauses:
@@ -98,9 +100,13 @@ const lbool l_Undef = toLbool( 0);
 // Clause -- a simple class for representing a clause:
 
 
+// Clauses live in a 'ClauseAllocator' and are referred to by their 32-bit offset in it.
+typedef uint32_t CRef;
+const CRef CRef_Undef = UINT32_MAX;
+
 class Clause {
     uint32_t size_etc;
-    union { float act; uint32_t abst; } extra;
+    union { float act; uint32_t abst; CRef rel; } extra;
     Lit     data[0];
 
 public:
@@ -113,15 +119,12 @@ public:
     // NOTE: This constructor cannot be used directly (doesn't allocate enough memory).
     template<class V>
     Clause(const V& ps, bool learnt) {
-        size_etc = (ps.size() << 3) | (uint32_t)learnt;
+        size_etc = (ps.size() << 4) | (uint32_t)learnt;
         for (int i = 0; i < ps.size(); i++) data[i] = ps[i];
         if (learnt) extra.act = 0; else calcAbstraction(); }
 
-    template<class V>
-    inline Clause* Clause_new(const V& ps, bool learnt = false);
-
-    int          size        ()      const   { return size_etc >> 3; }
-    void         shrink      (int i)         { assert(i <= size()); size_etc = (((size_etc >> 3) - i) << 3) | (size_etc & 7); }
+    int          size        ()      const   { return size_etc >> 4; }
+    void         shrink      (int i)         { assert(i <= size()); size_etc = (((size_etc >> 4) - i) << 4) | (size_etc & 15); }
     void         pop         ()              { shrink(1); }
     bool         learnt      ()      const   { return size_etc & 1; }
     uint32_t     mark        ()      const   { return (size_etc >> 1) & 3; }
@@ -137,6 +140,14 @@ public:
     float&       activity    ()              { return extra.act; }
     uint32_t     abstraction () const { return extra.abst; }
 
+    // Set once the clause has been copied to a new allocator; 'relocation()' is then its new reference.
+    bool         reloced     ()      const   { return size_etc & 8; }
+    CRef         relocation  ()      const   { return extra.rel; }
+    void         relocate    (CRef c)        { size_etc |= 8; extra.rel = c; }
+
+    // Size in 32-bit words of a clause of 'size' literals.
+    static int   words       (int size)      { return (sizeof(Clause) + sizeof(Lit) * size) / sizeof(uint32_t); }
+
     Lit          subsumes    (const Clause& other) const;
     void         strengthen  (Lit p);
 };
@@ -189,4 +200,66 @@ inline void Clause::strengthen(Lit p)
     calcAbstraction();
 }
 
+
+//=================================================================================================
+// ClauseAllocator -- a region of 32-bit words holding clauses back to back:
+//
+// Freed clauses only count as wasted space; it is reclaimed by copying the live clauses to a fresh
+// allocator with 'reloc()' and taking its memory over with 'moveTo()'. Clause references (and so
+// any 'Clause&') are invalidated when the region grows.
+
+
+class ClauseAllocator {
+    uint32_t* memory;
+    uint32_t  sz, cap, wasted_;
+
+    void capacity(uint32_t min_cap) {
+        if (cap >= min_cap) return;
+        while (cap < min_cap) {
+            uint32_t delta = ((cap >> 1) + (cap >> 3) + 2) & ~1;   // (grow by about 5/8)
+            assert(cap + delta > cap);
+            cap += delta; }
+        memory = (uint32_t*)realloc(memory, sizeof(uint32_t) * cap);
+        if (memory == NULL) throw std::bad_alloc(); }
+
+public:
+    ClauseAllocator(uint32_t start_cap = 1024 * 1024) : memory(NULL), sz(0), cap(0), wasted_(0) { capacity(start_cap); }
+    ~ClauseAllocator() { ::free(memory); }
+
+    template<class V>
+    CRef alloc(const V& ps, bool learnt = false) {
+        assert(sizeof(Lit)   == sizeof(uint32_t));
+        assert(sizeof(float) == sizeof(uint32_t));
+        uint32_t words = Clause::words(ps.size());
+        capacity(sz + words);
+        CRef cr = sz;
+        sz += words;
+        new (memory + cr) Clause(ps, learnt);
+        return cr; }
+
+    Clause&       operator [] (CRef cr)       { return *(Clause*)(memory + cr); }
+    const Clause& operator [] (CRef cr) const { return *(const Clause*)(memory + cr); }
+
+    void     free   (CRef cr)       { wasted_ += Clause::words((*this)[cr].size()); }
+    uint32_t size   ()        const { return sz; }
+    uint32_t wasted ()        const { return wasted_; }
+
+    // Moves the clause 'cr' to 'to' (once, however many references are updated) and updates 'cr'.
+    void reloc(CRef& cr, ClauseAllocator& to) {
+        Clause& c = (*this)[cr];
+        if (c.reloced()) { cr = c.relocation(); return; }
+        CRef copy = to.alloc(c, c.learnt());
+        Clause& d = to[copy];
+        d.mark(c.mark());
+        if (c.learnt()) d.activity() = c.activity();
+        else            d.calcAbstraction();
+        c.relocate(copy);
+        cr = copy; }
+
+    void moveTo(ClauseAllocator& to) {
+        ::free(to.memory);
+        to.memory = memory; to.sz = sz; to.cap = cap; to.wasted_ = wasted_;
+        memory = NULL; sz = cap = wasted_ = 0; }
+};
+
 #endif
@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+#
+# End-to-end benchmark of rcpsp-gpr-sat on the examples and on instances of progen.py: every instance of the
+# suite is solved in its own process through --batch --format json, so that the peak memory of the process is that of one instance.
+# The results are written as JSON and compared against a saved baseline; a case regresses when a time, memory or
+# solver counter grows by more than the threshold, or when its status or makespan changes.
+#
+#   bench/bench.py [--binary ./rcpsp-gpr-sat] [--baseline bench/baseline.json] [--update] [--threshold 0.25] [--time-threshold 0.5]
+#                  [--sizes 60,120,240] [--seed 1]
+#
+
+import argparse
+import glob
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+import progen
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.dirname(HERE)
+
+# Horizons as multiples of the makespan declared by the instance: the tight one is hard for the solver, the
+# loose ones grow the formula.
+HORIZONS = (1.0, 1.5, 2.0)
+
+# Options of each run, by name; the encoders of the instance are the defaults of the solver.
+CONFIGS = (
+    ("solve", ["--heuristic", "none"]),
+    ("bisect", ["--heuristic", "none", "--optimize", "bisect"]),
+)
+
+# Generated instances: their sizes, and horizons as multiples of the serial schedule makespan. Optimizing them
+# takes too long for a regression run, so they are only solved.
+SIZES = "60,120"
+GENERATED_HORIZONS = (1.0, 1.5)
+GENERATED_CONFIGS = CONFIGS[:1]
+
+# Compared against the baseline; times and memory below the floor are noise. Wall clock times vary more from run to
+# run than the deterministic solver counters, so they have their own threshold.
+COSTS = {"encode_seconds": 0.1, "solve_seconds": 0.1, "process_peak_mb": 8.0,
+         "decisions": 1000, "propagations": 100000, "conflicts": 100}
+TIMES = ("encode_seconds", "solve_seconds")
+OUTCOME = ("status", "makespan")
+SIZE = ("variables", "clauses")
+
+
+def with_horizon(text, factor):
+    """The PDSL text with the horizon of its PROJECT line scaled by factor, and that horizon."""
+    m = re.search(r"^(\s*project\s+\d+\s+)(\d+)", text, re.I | re.M)
+    if not m:
+        return None, 0
+    horizon = max(1, int(round(int(m.group(2)) * factor)))
+    return text[:m.start(2)] + str(horizon) + text[m.end(2):], horizon
+
+
+def instances(work, sizes, seed):
+    """(name, file, horizon, configs) of the suite, the scaled copies and the generated instances being written
+    to work."""
+    suite = []
+    for path in sorted(glob.glob(os.path.join(ROOT, "examples", "*.pdsl"))):
+        with open(path) as f:
+            text = f.read()
+        base = os.path.basename(path)[:-len(".pdsl")]
+        for factor in HORIZONS:
+            scaled, horizon = with_horizon(text, factor)
+            if scaled is None:
+                continue
+            file = os.path.join(work, "%s-t%d.pdsl" % (base, horizon))
+            with open(file, "w") as f:
+                f.write(scaled)
+            suite.append(("%s-t%d" % (base, horizon), file, horizon, CONFIGS))
+    for n in sizes:
+        for factor in GENERATED_HORIZONS:
+            inst = progen.generate(n, horizon_factor=factor, seed=seed)
+            name = "progen-n%d-s%d-t%d" % (n, seed, inst.horizon)
+            file = os.path.join(work, name + ".pdsl")
+            with open(file, "w") as f:
+                inst.write(f)
+            suite.append((name, file, inst.horizon, GENERATED_CONFIGS))
+    return suite
+
+
+def run(binary, file, options, timeout):
+    """The JSON row of one instance, or only a status on a crash or a timeout."""
+    with tempfile.NamedTemporaryFile("w", suffix=".list", delete=False) as manifest:
+        manifest.write(file + "\n")
+    try:
+        out = subprocess.run([binary, "--batch", manifest.name, "--jobs", "1", "--format", "json"] + options,
+                             stdout=subprocess.PIPE, stderr=subprocess.DEVNULL, timeout=timeout, check=False)
+        rows = out.stdout.decode().splitlines()
+        return json.loads(rows[0]) if rows else {"status": "crash"}
+    except subprocess.TimeoutExpired:
+        return {"status": "timeout"}
+    finally:
+        os.unlink(manifest.name)
+
+
+def measure(binary, file, options, repeat, timeout):
+    """Best times and median memory of repeat runs; the other fields are deterministic and taken from the first run."""
+    rows = []
+    for _ in range(repeat):
+        row = run(binary, file, options, timeout)
+        if "instance" not in row:
+            return row
+        rows.append(row)
+    result = dict(rows[0])
+    del result["instance"]
+    for key in TIMES:
+        result[key] = min(r[key] for r in rows)
+    result["process_peak_mb"] = sorted(r["process_peak_mb"] for r in rows)[len(rows) // 2]
+    return result
+
+
+def compare(results, baseline, threshold, time_threshold):
+    """Lines describing every regression of results against baseline, and the number of cases compared."""
+    old = {c["name"]: c for c in baseline["cases"]}
+    problems, compared = [], 0
+    for case in results["cases"]:
+        before = old.get(case["name"])
+        if before is None:
+            continue
+        compared += 1
+        for key in OUTCOME:
+            if case.get(key) != before.get(key):
+                problems.append("%s: %s %s, was %s" % (case["name"], key, case.get(key), before.get(key)))
+        for key, floor in COSTS.items():
+            a, b = before.get(key), case.get(key)
+            if a is None or b is None or max(a, b) < floor:
+                continue
+            if b > max(a, floor) * (1 + (time_threshold if key in TIMES else threshold)):
+                problems.append("%s: %s %g, was %g (+%.0f%%)" % (case["name"], key, b, a, 100.0 * (b - a) / max(a, floor)))
+        for key in SIZE:
+            if case.get(key) != before.get(key):
+                print("Note: %s: %s %s, was %s" % (case["name"], key, case.get(key), before.get(key)))
+    return problems, compared
+
+
+def main():
+    parser = argparse.ArgumentParser(description="End-to-end benchmark of rcpsp-gpr-sat.")
+    parser.add_argument("--binary", default=os.path.join(ROOT, "rcpsp-gpr-sat"))
+    parser.add_argument("--baseline", default=os.path.join(HERE, "baseline.json"))
+    parser.add_argument("--output", default=os.path.join(HERE, "results.json"))
+    parser.add_argument("--update", action="store_true", help="write the results as the new baseline")
+    parser.add_argument("--threshold", type=float, default=0.25, help="relative growth counted as a regression")
+    parser.add_argument("--time-threshold", type=float, default=0.5, help="the same, for the encoding and solving times")
+    parser.add_argument("--repeat", type=int, default=3, help="runs per case, the best time is kept")
+    parser.add_argument("--timeout", type=float, default=300, help="seconds per run")
+    parser.add_argument("--filter", default="", help="only the cases whose name contains this text")
+    parser.add_argument("--sizes", default=SIZES, help="activities of the generated instances, comma separated")
+    parser.add_argument("--seed", type=int, default=1, help="seed of the generated instances")
+    args = parser.parse_args()
+    sizes = [int(n) for n in args.sizes.split(",") if n.strip()]
+
+    results = {"binary": args.binary, "date": time.strftime("%Y-%m-%d %H:%M:%S"), "cases": []}
+    with tempfile.TemporaryDirectory() as work:
+        for name, file, horizon, configs in instances(work, sizes, args.seed):
+            for config, options in configs:
+                case = "%s/%s" % (name, config)
+                if args.filter not in case:
+                    continue
+                row = measure(args.binary, file, options, args.repeat, args.timeout)
+                row.update({"name": case, "horizon": horizon, "options": " ".join(options)})
+                results["cases"].append(row)
+                print("%-32s %-10s makespan %4s  %7s clauses  encode %7.3fs  solve %7.3fs  %7.1f MB  %9s conflicts"
+                      % (case, row["status"], row.get("makespan", "-"), row.get("clauses", "-"),
+                         row.get("encode_seconds", 0), row.get("solve_seconds", 0),
+                         row.get("process_peak_mb", 0), row.get("conflicts", "-")))
+                sys.stdout.flush()
+
+    with open(args.update and args.baseline or args.output, "w") as f:
+        json.dump(results, f, indent=1, sort_keys=True)
+        f.write("\n")
+    if args.update:
+        print("Baseline saved to %s" % args.baseline)
+        return 0
+    if not os.path.exists(args.baseline):
+        print("No baseline %s: run with --update to create one" % args.baseline)
+        return 1
+    with open(args.baseline) as f:
+        baseline = json.load(f)
+    problems, compared = compare(results, baseline, args.threshold, args.time_threshold)
+    for p in problems:
+        print("Regression: %s" % p)
+    print("%d of %d cases compared with %s, %d regressions" % (compared, len(results["cases"]), args.baseline, len(problems)))
+    return 1 if problems else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#
+# ProGen-style generator of PDSL instances for scaling studies. The same parameters and seed always give the same
+# instance. Relations run from lower to higher activity numbers, so the network has no cycle, and the horizon
+# defaults to the makespan of a serial schedule generation scheme, so the instance is feasible.
+#
+#   bench/progen.py --activities 1000 --resources 4 --complexity 1.5 --mix FS=70,SS=10,FF=10,SF=10 \
+#                   --resource-factor 0.5 --resource-strength 0.3 --seed 1 [--horizon T | --horizon-factor F] [-o file]
+#
+
+import argparse
+import random
+import sys
+
+TYPES = ("SS", "SF", "FS", "FF")
+
+
+def lag(kind, d1, d2):
+    """Minimum distance from the start of the first activity to the start of the second, as the solver reads it."""
+    return {"SS": 1, "SF": 2 - d2, "FS": d1, "FF": d1 - d2 + 1}[kind]
+
+
+def parse_mix(text):
+    """Relation type weights from "FS=70,SS=10,...", the missing types weighing nothing."""
+    mix = dict.fromkeys(TYPES, 0.0)
+    for item in text.split(","):
+        kind, _, weight = item.partition("=")
+        kind = kind.strip().upper()
+        if kind not in mix or not weight:
+            raise ValueError("invalid relation mix %r" % text)
+        mix[kind] = float(weight)
+    if sum(mix.values()) <= 0:
+        raise ValueError("invalid relation mix %r" % text)
+    return mix
+
+
+class Instance:
+    """activities durations, relations (a, b, type), resource capacities and demands[act][res]; 0-based."""
+
+    def __init__(self, n, resources):
+        self.duration = [1] * n
+        self.relations = []
+        self.capacity = [0] * resources
+        self.demand = [[0] * resources for _ in range(n)]
+        self.horizon = 0
+        self.comment = []
+
+    def predecessors(self):
+        pred = [[] for _ in self.duration]
+        for a, b, kind in self.relations:
+            pred[b].append((a, lag(kind, self.duration[a], self.duration[b])))
+        return pred
+
+    def earliest_starts(self):
+        """Without resources; activity numbers are a topological order."""
+        start = [0] * len(self.duration)
+        for b, pred in enumerate(self.predecessors()):
+            for a, l in pred:
+                start[b] = max(start[b], start[a] + l)
+        return start
+
+    def serial_makespan(self):
+        """Serial schedule generation scheme in activity order, each activity at its earliest feasible start."""
+        start = [0] * len(self.duration)
+        used = [[] for _ in self.capacity]
+        for b, pred in enumerate(self.predecessors()):
+            t = max([0] + [start[a] + l for a, l in pred])
+            d = self.duration[b]
+            while not all(self.fits(used[r], t, d, self.demand[b][r], self.capacity[r]) for r in range(len(self.capacity))):
+                t += 1
+            start[b] = t
+            for r in range(len(self.capacity)):
+                if self.demand[b][r]:
+                    if len(used[r]) < t + d:
+                        used[r].extend([0] * (t + d - len(used[r])))
+                    for p in range(t, t + d):
+                        used[r][p] += self.demand[b][r]
+        return max([s + d for s, d in zip(start, self.duration)] + [1])
+
+    @staticmethod
+    def fits(used, t, d, q, capacity):
+        return q == 0 or all(p >= len(used) or used[p] + q <= capacity for p in range(t, t + d))
+
+    def write(self, f):
+        for line in self.comment:
+            f.write("# %s\n" % line)
+        f.write("PROJECT %d %d %d\n" % (len(self.duration), self.horizon, len(self.capacity)))
+        for act, d in enumerate(self.duration):
+            f.write("ACTIVITY %d %d\n" % (act + 1, d))
+        for a, b, kind in self.relations:
+            f.write("SEQUENCE %d %d %s\n" % (a + 1, b + 1, kind))
+        for res, c in enumerate(self.capacity):
+            f.write("RESOURCE %d %d\n" % (res + 1, c))
+        for act, demand in enumerate(self.demand):
+            for res, q in enumerate(demand):
+                if q:
+                    f.write("ALLOCATE %d %d %d\n" % (act + 1, res + 1, q))
+
+
+def generate(activities, resources=4, complexity=1.5, mix="FS=70,SS=10,FF=10,SF=10", resource_factor=0.5,
+             resource_strength=0.3, max_duration=10, max_demand=10, horizon=0, horizon_factor=1.0, seed=1):
+    """An Instance, from the ProGen parameters:
+    complexity         relations per activity (network complexity), at least enough for a connected network;
+    mix                weights of the relation types;
+    resource_factor    share of the resources demanded by an activity;
+    resource_strength  capacity between the largest demand (0) and the peak of the earliest start schedule (1);
+    horizon            the makespan of the project, or else horizon_factor times that of the serial scheme."""
+    rnd = random.Random(seed)
+    weights = parse_mix(mix)
+    n = activities
+    inst = Instance(n, resources)
+    inst.duration = [rnd.randint(1, max_duration) for _ in range(n)]
+
+    # A predecessor for every activity but the first few, a successor for every activity but the last few, then
+    # random relations up to the complexity.
+    ends = max(1, min(3, n // 10))
+    arcs = set()
+    for b in range(ends, n):
+        arcs.add((rnd.randrange(b), b))
+    has_successor = set(a for a, _ in arcs)
+    for a in range(n - ends):
+        if a not in has_successor:
+            arcs.add((a, rnd.randrange(a + 1, n)))
+    target = int(round(complexity * n))
+    while len(arcs) < min(target, n * (n - 1) // 2):
+        a, b = sorted(rnd.sample(range(n), 2))
+        arcs.add((a, b))
+    kinds = [k for k in TYPES if weights[k] > 0]
+    for a, b in sorted(arcs):
+        kind = rnd.choices(kinds, [weights[k] for k in kinds])[0]
+        inst.relations.append((a, b, kind))
+
+    # Demands: each resource with probability resource_factor, at least one per activity.
+    for act in range(n):
+        used = [r for r in range(resources) if rnd.random() < resource_factor]
+        if not used:
+            used = [rnd.randrange(resources)]
+        for r in used:
+            inst.demand[act][r] = rnd.randint(1, max_demand)
+
+    # Capacities from the resource strength, as in ProGen: between the largest demand and the peak demand.
+    start = inst.earliest_starts()
+    span = max(s + d for s, d in zip(start, inst.duration))
+    for r in range(resources):
+        profile = [0] * span
+        for act in range(n):
+            for t in range(start[act], start[act] + inst.duration[act]):
+                profile[t] += inst.demand[act][r]
+        rmin = max([inst.demand[act][r] for act in range(n)] + [1])
+        rmax = max(profile + [rmin])
+        inst.capacity[r] = rmin + int(round(resource_strength * (rmax - rmin)))
+
+    inst.horizon = horizon if horizon > 0 else max(1, int(round(horizon_factor * inst.serial_makespan())))
+    inst.comment = ["progen.py --activities %d --resources %d --complexity %g --mix %s --resource-factor %g "
+                    "--resource-strength %g --max-duration %d --max-demand %d --seed %d"
+                    % (activities, resources, complexity, mix, resource_factor, resource_strength,
+                       max_duration, max_demand, seed),
+                    "%d relations, horizon %d" % (len(inst.relations), inst.horizon)]
+    return inst
+
+
+def main():
+    parser = argparse.ArgumentParser(description="ProGen-style generator of PDSL instances.")
+    parser.add_argument("--activities", type=int, default=30)
+    parser.add_argument("--resources", type=int, default=4)
+    parser.add_argument("--complexity", type=float, default=1.5, help="relations per activity")
+    parser.add_argument("--mix", default="FS=70,SS=10,FF=10,SF=10", help="weights of the relation types")
+    parser.add_argument("--resource-factor", type=float, default=0.5)
+    parser.add_argument("--resource-strength", type=float, default=0.3)
+    parser.add_argument("--max-duration", type=int, default=10)
+    parser.add_argument("--max-demand", type=int, default=10)
+    parser.add_argument("--horizon", type=int, default=0, help="the makespan of the project")
+    parser.add_argument("--horizon-factor", type=float, default=1.0,
+                        help="without --horizon, times the makespan of the serial schedule generation scheme")
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("-o", "--output", help="PDSL file, the standard output by default")
+    args = parser.parse_args()
+    if args.activities < 1 or args.resources < 1 or args.max_duration < 1 or args.max_demand < 1:
+        parser.error("activities, resources, durations and demands must be positive")
+    try:
+        inst = generate(args.activities, args.resources, args.complexity, args.mix, args.resource_factor,
+                        args.resource_strength, args.max_duration, args.max_demand, args.horizon,
+                        args.horizon_factor, args.seed)
+    except ValueError as e:
+        parser.error(str(e))
+    if args.output:
+        with open(args.output, "w") as f:
+            inst.write(f)
+    else:
+        inst.write(sys.stdout)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
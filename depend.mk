@@ -1,68 +1,176 @@
+Main.o: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C \
+ batch.C
+Solver.o: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h mtl/Sort.h
+backend.o: backend.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+batch.o: batch.C pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
+bounds.o: bounds.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+cache.o: cache.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
 cnf.o: cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
  SolverTypes.h
+cubes.o: cubes.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h
 graph.o: graph.C
-Main.o: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
- mtl/Vec.h
+optimize.o: optimize.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 pdsl.o: pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
 planning.o: planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
+portfolio.o: portfolio.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+pseudobool.o: pseudobool.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+psplib.o: psplib.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 resources.o: resources.C mtl/Vec.h
 satvar.o: satvar.C
-Solver.o: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h mtl/Sort.h
+sgs.o: sgs.C
 verify.o: verify.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
  mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
- mtl/Vec.h
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+Main.op: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C \
+ batch.C
+Solver.op: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h mtl/Sort.h
+backend.op: backend.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+batch.op: batch.C pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
+bounds.op: bounds.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+cache.op: cache.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
 cnf.op: cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
  SolverTypes.h
+cubes.op: cubes.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h
 graph.op: graph.C
-Main.op: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
- mtl/Vec.h
+optimize.op: optimize.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 pdsl.op: pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
 planning.op: planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
+portfolio.op: portfolio.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+pseudobool.op: pseudobool.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+psplib.op: psplib.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 resources.op: resources.C mtl/Vec.h
 satvar.op: satvar.C
-Solver.op: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h mtl/Sort.h
+sgs.op: sgs.C
 verify.op: verify.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
  mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
- mtl/Vec.h
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+Main.od: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C \
+ batch.C
+Solver.od: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h mtl/Sort.h
+backend.od: backend.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+batch.od: batch.C pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
+bounds.od: bounds.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+cache.od: cache.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
 cnf.od: cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
  SolverTypes.h
+cubes.od: cubes.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h
 graph.od: graph.C
-Main.od: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
- mtl/Vec.h
+optimize.od: optimize.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 pdsl.od: pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
 planning.od: planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
+portfolio.od: portfolio.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+pseudobool.od: pseudobool.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+psplib.od: psplib.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 resources.od: resources.C mtl/Vec.h
 satvar.od: satvar.C
-Solver.od: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h mtl/Sort.h
+sgs.od: sgs.C
 verify.od: verify.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
  mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
- mtl/Vec.h
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+Main.or: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C \
+ batch.C
+Solver.or: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h mtl/Sort.h
+backend.or: backend.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+batch.or: batch.C pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
+bounds.or: bounds.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
+cache.or: cache.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
 cnf.or: cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
  SolverTypes.h
+cubes.or: cubes.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
+ SolverTypes.h
 graph.or: graph.C
-Main.or: Main.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h pdsl.C planning.C satvar.C cnf.C graph.C resources.C \
- mtl/Vec.h
+optimize.or: optimize.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 pdsl.or: pdsl.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C psplib.C
 planning.or: planning.C satvar.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h \
- mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h
+ mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C mtl/Vec.h \
+ pseudobool.C backend.C portfolio.C cubes.C sgs.C
+portfolio.or: portfolio.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+pseudobool.or: pseudobool.C cnf.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h \
+ mtl/Alg.h SolverTypes.h
+psplib.or: psplib.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
+ mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
 resources.or: resources.C mtl/Vec.h
 satvar.or: satvar.C
-Solver.or: Solver.C Solver.h mtl/Vec.h mtl/Heap.h mtl/Vec.h mtl/Alg.h \
- SolverTypes.h mtl/Sort.h
+sgs.or: sgs.C
 verify.or: verify.C planning.C satvar.C cnf.C Solver.h mtl/Vec.h \
  mtl/Heap.h mtl/Vec.h mtl/Alg.h SolverTypes.h graph.C resources.C \
- mtl/Vec.h
+ mtl/Vec.h pseudobool.C backend.C portfolio.C cubes.C sgs.C
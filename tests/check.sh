@@ -0,0 +1,61 @@
+#!/bin/sh
+#
+# Regression checks of rcpsp-gpr-sat: every case runs the solver and looks for a line in its output.
+#
+#   tests/check.sh [./rcpsp-gpr-sat]
+#
+
+BIN=${1:-./rcpsp-gpr-sat}
+DIR=$(dirname "$0")
+TMP=$(mktemp -d)
+trap 'rm -rf "$TMP"' EXIT
+FAILED=0
+
+# expect <name> <pattern> <arguments of the solver>...: the solver exits normally and prints the pattern.
+expect()
+{
+  name=$1 pattern=$2
+  shift 2
+  out=$(timeout 300 "$BIN" "$@" 2>&1)
+  status=$?
+  if [ $status -lt 128 ] && printf '%s\n' "$out" | grep -q -- "$pattern"; then
+    echo "ok   $name"
+  else
+    echo "FAIL $name (exit $status)"
+    printf '%s\n' "$out" | tail -5
+    FAILED=1
+  fi
+}
+
+# Only portfolio worker 0 takes the phases of the formula (the heuristic schedule when it fits the horizon, and
+# always with --branching schedule): the other workers keep their polarity mode
+for f in "$DIR"/../examples/*.pdsl; do
+  expect "portfolio $(basename $f)" "Verifies ok" "$f" --threads 2
+  for w in "0 schedule" "1 true" "2 random"; do
+    set -- $w
+    expect "portfolio worker $1 $(basename $f)" "solver $1 loaded (.*polarity $2" "$f" --threads 3 --branching schedule
+  done
+  expect "portfolio bisect $(basename $f)" "Optimal makespan" "$f" --threads 2 --optimize bisect --heuristic sgs
+done
+
+# ProGen/max instance with a doubly constrained resource, whose columns are read and ignored
+expect "import doubly.sch" "Optimal makespan: 13" "$DIR/doubly.sch" --optimize bisect
+
+# A truncated formula cache is encoded again
+expect "cache write" "Verifies ok" "$DIR/../examples/j301_1.sm.pdsl" --cache "$TMP"
+for c in "$TMP"/*.cnfc; do truncate -s 4096 "$c"; done
+expect "cache truncated" "ignoring formula cache" "$DIR/../examples/j301_1.sm.pdsl" --cache "$TMP"
+expect "cache rewritten" "(cache " "$DIR/../examples/j301_1.sm.pdsl" --cache "$TMP"
+
+# A cache hit still writes the DIMACS file, the same as the encoding did
+mkdir "$TMP/dimacs"
+expect "cache dimacs encoded" "Verifies ok" "$DIR/../examples/j301_2.sm.pdsl" --cache "$TMP/dimacs" --dimacs "$TMP/a.cnf"
+expect "cache dimacs cached" "(cache " "$DIR/../examples/j301_2.sm.pdsl" --cache "$TMP/dimacs" --dimacs "$TMP/b.cnf"
+if cmp -s "$TMP/a.cnf" "$TMP/b.cnf"; then
+  echo "ok   cache dimacs file"
+else
+  echo "FAIL cache dimacs file"
+  FAILED=1
+fi
+
+exit $FAILED